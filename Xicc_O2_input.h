@@ -0,0 +1,102 @@
+#ifndef XICC_O2_INPUT_H
+#define XICC_O2_INPUT_H
+
+/// Reading of the O2 output (AnalysisResults files with DF_* directories of O2hfxicc4full trees),
+/// shared by Xicc_O2_to_TMVA_convert.C and Xicc_BDT_apply.C
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "TChain.h"
+#include "TClass.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TKey.h"
+#include "TRegexp.h"
+#include "TString.h"
+#include "TSystem.h"
+
+/// <summary>
+/// Expand an input file name which may contain wildcards (*, ?, [...]) in any path component,
+/// e.g. "output_o2/*/AnalysisResults_trees_O2.root". Matches are sorted, so the chain order is reproducible.
+/// </summary>
+inline void ExpandInputFiles(const TString& pattern, std::vector<TString>& files)
+{
+  if (!pattern.MaybeWildcard()) {
+    if (gSystem->AccessPathName(pattern)) {
+      printf("input file %s not found, skipping\n", pattern.Data());
+      return;
+    }
+    files.push_back(pattern);
+    return;
+  }
+
+  // expand the first path component containing a wildcard, then the rest of the pattern recursively
+  Ssiz_t wild = pattern.First("*?[");
+  Ssiz_t slash = TString(pattern(0, wild)).Last('/');
+  Ssiz_t next = pattern.Index("/", wild);
+  if (next == kNPOS) next = pattern.Length();
+  TString dir = (slash == kNPOS) ? TString(".") : (slash == 0 ? TString("/") : TString(pattern(0, slash)));
+  TString prefix = (slash == kNPOS) ? TString("") : TString(pattern(0, slash + 1));
+  TString rest = pattern(next, pattern.Length() - next);
+  TRegexp component(TString(pattern(slash + 1, next - slash - 1)), kTRUE);
+
+  void* dirp = gSystem->OpenDirectory(dir);
+  if (!dirp) {return;}
+  std::vector<TString> matches;
+  while (const char* entry = gSystem->GetDirEntry(dirp)) {
+    TString name(entry);
+    if (name == "." || name == "..") {continue;}
+    if (name.Index(component) == 0) matches.push_back(prefix + name + rest);
+  }
+  gSystem->FreeDirectory(dirp);
+
+  std::sort(matches.begin(), matches.end());
+  for (auto& match : matches) ExpandInputFiles(match, files);
+}
+
+/// <summary>
+/// Add the O2hfxicc4full tree of every DF_* directory of an AnalysisResults file to the chain.
+/// The DF directories are found by walking the key list of the file instead of probing DF_0...DF_5999,
+/// and are added in numerical order. The trees themselves are only opened when the chain reads them.
+/// </summary>
+inline Int_t AddDFTreesToChain(TChain& chain, const TString& fileName)
+{
+  std::unique_ptr<TFile> file(TFile::Open(fileName));
+  if (!file || file->IsZombie()) {
+    printf("could not open %s, skipping\n", fileName.Data());
+    return 0;
+  }
+
+  std::vector<std::pair<Long64_t, TString>> dfDirs;
+  TIter nextKey(file->GetListOfKeys());
+  while (TKey* key = (TKey*)nextKey()) {
+    TString keyName = key->GetName();
+    if (!keyName.BeginsWith("DF_")) {continue;}
+    TString dfNumber = keyName(3, keyName.Length() - 3);
+    if (!dfNumber.IsDigit()) {continue;}
+    TClass* keyClass = TClass::GetClass(key->GetClassName());
+    if (keyClass == nullptr || !keyClass->InheritsFrom(TDirectory::Class())) {continue;}
+    dfDirs.emplace_back(dfNumber.Atoll(), keyName);
+  }
+  std::sort(dfDirs.begin(), dfDirs.end());
+  dfDirs.erase(std::unique(dfDirs.begin(), dfDirs.end()), dfDirs.end()); //several cycles of the same key
+
+  Int_t nAdded = 0;
+  for (auto& dfDir : dfDirs) {
+    TDirectory* dir = file->GetDirectory(dfDir.second);
+    if (dir == nullptr || dir->GetKey("O2hfxicc4full") == nullptr) {continue;}
+    chain.Add(fileName + "/" + dfDir.second + "/O2hfxicc4full");
+    nAdded++;
+  }
+  return nAdded;
+}
+
+/// Branches used by Xicc_BDT_test.C (variables, spectators and the sig/bkg flag)
+const char* const kBDTBranches = "fCPA,fCPAXY,fDecayLength,fDecayLengthXY,fImpactParameter0,fImpactParameter1,"
+                                 "fImpactParameter2,fImpactParameter3,fChi2PCA,fM,fPt,fMCflag";
+
+#endif
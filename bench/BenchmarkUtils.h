@@ -0,0 +1,84 @@
+#ifndef XICC_BENCHMARK_UTILS_H
+#define XICC_BENCHMARK_UTILS_H
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "TFile.h"
+#include "TStopwatch.h"
+#include "TString.h"
+
+/// <summary>
+/// Measurement of the stages of a benchmark: wall and CPU time, number of processed items (events, candidates, ...),
+/// bytes read and written through TFile and the peak resident memory of the stage.
+/// Every stage is written as one JSON object per line, so a run can be compared against a stored baseline.
+/// </summary>
+class BenchmarkReport
+{
+ public:
+  BenchmarkReport(const TString& input_benchmark, const TString& fileName) : benchmark(input_benchmark), out(fileName.Data()) {}
+
+  /// add a text field to all following records, e.g. the compiler flags of the run
+  void AddInfo(const TString& key, const TString& value) { info[key] = value; }
+
+  /// start measuring a stage
+  void Start(const TString& input_stage)
+  {
+    stage = input_stage;
+    ResetPeakRSS();
+    bytesRead = TFile::GetFileBytesRead();
+    bytesWritten = TFile::GetFileBytesWritten();
+    watch.Start(kTRUE);
+  }
+
+  /// stop the current stage and write its record, extra holds additional numeric fields of the stage
+  void Stop(Long64_t nItems, const TString& unit, const std::map<TString, Double_t>& extra = {})
+  {
+    watch.Stop();
+    const Double_t wall = watch.RealTime();
+    TString record = Form("{\"benchmark\": \"%s\", \"stage\": \"%s\", \"items\": %lld, \"unit\": \"%s\", "
+                          "\"wall_s\": %.6g, \"cpu_s\": %.6g, \"items_per_s\": %.6g, "
+                          "\"bytes_read\": %lld, \"bytes_written\": %lld, \"peak_rss_kb\": %lld",
+                          benchmark.Data(), stage.Data(), nItems, unit.Data(), wall, watch.CpuTime(),
+                          wall > 0 ? nItems / wall : 0., TFile::GetFileBytesRead() - bytesRead,
+                          TFile::GetFileBytesWritten() - bytesWritten, GetPeakRSS());
+    for (auto& field : extra) record += Form(", \"%s\": %.6g", field.first.Data(), field.second);
+    for (auto& field : info) record += Form(", \"%s\": \"%s\"", field.first.Data(), field.second.Data());
+    record += "}";
+    out << record << std::endl;
+    std::cout << record << std::endl;
+  }
+
+ private:
+  /// reset the high water mark of the resident memory (Linux >= 4.0); without it the peak of the whole process is reported
+  static void ResetPeakRSS()
+  {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) clearRefs << "5";
+  }
+
+  /// peak resident memory in kB (VmHWM), -1 if not available
+  static Long64_t GetPeakRSS()
+  {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    Long64_t value;
+    while (status >> key) {
+      if (key == "VmHWM:" && status >> value) return value;
+      status.ignore(1024, '\n');
+    }
+    return -1;
+  }
+
+  TString benchmark;
+  TString stage;
+  std::map<TString, TString> info;
+  std::ofstream out;
+  TStopwatch watch;
+  Long64_t bytesRead = 0;
+  Long64_t bytesWritten = 0;
+};
+
+#endif
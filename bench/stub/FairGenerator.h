@@ -0,0 +1,17 @@
+#ifndef XICC_BENCHMARK_STUB_FAIRGENERATOR_H
+#define XICC_BENCHMARK_STUB_FAIRGENERATOR_H
+
+#include "TNamed.h"
+
+class FairPrimaryGenerator;
+
+/// Stand-in for FairRoot's FairGenerator, to build generator_pythia8_PbPb.C without FairRoot and O2
+class FairGenerator : public TNamed
+{
+ public:
+  virtual ~FairGenerator() = default;
+  virtual Bool_t Init() { return kTRUE; }
+  virtual Bool_t ReadEvent(FairPrimaryGenerator* primGen) = 0;
+};
+
+#endif
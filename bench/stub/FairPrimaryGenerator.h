@@ -0,0 +1,9 @@
+#ifndef XICC_BENCHMARK_STUB_FAIRPRIMARYGENERATOR_H
+#define XICC_BENCHMARK_STUB_FAIRPRIMARYGENERATOR_H
+
+/// Stand-in for FairRoot's FairPrimaryGenerator, only needed as a type by the benchmark
+class FairPrimaryGenerator
+{
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef XICC_BENCHMARK_STUB_GENERATORPYTHIA8_H
+#define XICC_BENCHMARK_STUB_GENERATORPYTHIA8_H
+
+#include "Pythia8/Pythia.h"
+#include "FairGenerator.h"
+#include "TF1.h"
+#include "TLorentzVector.h"
+#include "TMath.h"
+
+namespace o2
+{
+namespace eventgen
+{
+
+/// Stand-in for o2::eventgen::GeneratorPythia8 without the transport: mPythia only decays the particles
+/// put into its event record by generateEvent(), as in the O2 configuration of the injected generators
+class GeneratorPythia8 : public FairGenerator
+{
+ public:
+  Bool_t Init() override
+  {
+    mPythia.readString("ProcessLevel:all = off");
+    mPythia.readString("Next:numberCount = 0");
+    return mPythia.init();
+  }
+  Bool_t ReadEvent(FairPrimaryGenerator*) override { return generateEvent(); }
+
+ protected:
+  virtual Bool_t generateEvent() { return mPythia.next(); }
+
+  Pythia8::Pythia mPythia;
+};
+
+} // namespace eventgen
+} // namespace o2
+
+#endif